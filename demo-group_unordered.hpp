@@ -0,0 +1,312 @@
+#ifndef ANNEX_RANGE_TRANSFORMATION_GROUP_UNORDERED_HPP_INCLUDED
+#define ANNEX_RANGE_TRANSFORMATION_GROUP_UNORDERED_HPP_INCLUDED
+
+#include "annex/range/transformation/group.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace annex::range {
+
+namespace functors { struct group_unordered; }
+
+template<Variable Proj, Variable Hash, Variable Equiv, Saveable Ctx>
+    requires
+        RandomAccessContext<Ctx>
+        && impl::Groupable<Proj, Equiv, Ctx>
+        && Invokable<meta::as_const<Hash&>, meta::as_const<impl::projection_t<Proj, Ctx>&>>
+struct unordered_group_context {
+    Ctx grouped_context;
+
+    struct class_context {
+        Ctx grouped_context;
+
+    private:
+        friend unordered_group_context;
+        position_t<Ctx> start;
+
+        constexpr class_context(Ctx ctx, position_t<Ctx> start)
+            : grouped_context(std::forward<Ctx>(ctx))
+            , start(std::move(start))
+        {}
+
+    public:
+        // points into the offsets of the elements of all classes, which are stored by the unordered_group_context
+        using position_type = difference_t<Ctx> const*;
+
+        constexpr bool equal_pos(position_type x, position_type y)
+        { return x == y; }
+
+        constexpr decltype(auto) at(position_type pos)
+        {
+            auto element = start;
+            range::advance(grouped_context, element, *pos);
+            return range::at(grouped_context, element);
+        }
+
+        constexpr void incr(position_type& pos)
+        { ++pos; }
+
+        constexpr void decr(position_type& pos)
+        { --pos; }
+
+        constexpr void advance(position_type& pos, std::ptrdiff_t n)
+        { pos += n; }
+
+        constexpr std::ptrdiff_t distance(position_type x, position_type y)
+        { return y - x; }
+    };
+
+private:
+    friend functors::group_unordered;
+    position_t<Ctx> start;
+    // the offsets of the elements, class by class
+    std::vector<difference_t<Ctx>> members;
+    // where each class starts in members, followed by the number of elements
+    std::vector<std::size_t> class_starts;
+
+    unordered_group_context(Ctx ctx, position_t<Ctx> start, meta::as_const<Proj&> proj, meta::as_const<Hash&> hash,
+                            meta::as_const<Equiv&> equiv, difference_t<Ctx> length)
+        : grouped_context(std::forward<Ctx>(ctx))
+        , start(std::move(start))
+    {
+        using criterion_type = impl::criterion_t<Proj, Ctx>;
+
+        // the bookkeeping below is only needed while bucketing, and is allocated from an arena released all at once --
+        // its first block is sized for the class of each element
+        std::pmr::monotonic_buffer_resource arena(static_cast<std::size_t>(length) * sizeof(std::size_t) + 1024);
+
+        // open addressing table of class numbers plus one, with a power of two size and linear probing
+        int table_bits = 4;
+        std::pmr::vector<std::size_t> table(std::size_t { 1 } << table_bits, &arena);
+        std::pmr::vector<optional<criterion_type>> criteria(&arena);
+        std::pmr::vector<std::size_t> hashes(&arena);
+        std::pmr::vector<std::size_t> class_of(static_cast<std::size_t>(length), &arena);
+
+        auto const slot_of = [&](std::size_t hashed) {
+            // Fibonacci hashing: the high bits of the product depend on all the bits of the hash, so that the likes of
+            // multiples of a power of two hashed to themselves are spread too
+            return static_cast<std::size_t>((std::uint64_t { hashed } * std::uint64_t { 0x9e3779b97f4a7c15 })
+                                            >> (64 - table_bits));
+        };
+        auto const rehash = [&] {
+            table.assign(std::size_t { 1 } << ++table_bits, 0);
+            for(std::size_t klass = 0; klass != hashes.size(); ++klass) {
+                auto slot = slot_of(hashes[klass]);
+                for(; table[slot] != 0; slot = (slot + 1) & (table.size() - 1)) {}
+                table[slot] = klass + 1;
+            }
+        };
+
+        auto pos = this->start;
+        for(difference_t<Ctx> offset = 0; offset != length; ++offset, range::incr(grouped_context, pos)) {
+            criterion_type criterion = invoke(proj, range::peek_at(grouped_context, pos));
+            std::size_t const hashed = invoke(hash, as_const(criterion));
+
+            auto slot = slot_of(hashed);
+            for(; table[slot] != 0; slot = (slot + 1) & (table.size() - 1)) {
+                auto const klass = table[slot] - 1;
+                if(hashes[klass] == hashed && invoke(equiv, as_const(*criteria[klass]), as_const(criterion))) {
+                    break;
+                }
+            }
+
+            if(table[slot] == 0) {
+                table[slot] = hashes.size() + 1;
+                hashes.push_back(hashed);
+                criteria.emplace_back(std::forward<criterion_type>(criterion));
+                class_starts.push_back(0);
+            }
+
+            class_of[offset] = table[slot] - 1;
+            ++class_starts[class_of[offset]];
+            if(2 * hashes.size() > table.size()) {
+                rehash();
+            }
+        }
+
+        // class sizes to class starts
+        std::size_t next = 0;
+        for(auto& klass: class_starts) {
+            next += std::exchange(klass, next);
+        }
+        class_starts.push_back(next);
+
+        members.resize(length);
+        auto fill = class_starts;
+        for(difference_t<Ctx> offset = 0; offset != length; ++offset) {
+            members[fill[class_of[offset]]++] = offset;
+        }
+    }
+
+public:
+    using position_type = std::size_t;
+
+    bool equal_pos(position_type x, position_type y)
+    { return x == y; }
+
+    bounded_context<class_context> at(position_type pos)
+    {
+        return {
+            { grouped_context, start },
+            members.data() + class_starts[pos],
+            members.data() + class_starts[pos + 1],
+        };
+    }
+
+    void incr(position_type& pos)
+    { ++pos; }
+
+    void decr(position_type& pos)
+    { --pos; }
+
+    void advance(position_type& pos, std::ptrdiff_t n)
+    { pos += n; }
+
+    std::ptrdiff_t distance(position_type x, position_type y)
+    { return static_cast<std::ptrdiff_t>(y) - static_cast<std::ptrdiff_t>(x); }
+};
+
+/**
+ * .. type:: template<Variable Proj, Variable Hash, Variable Equiv, Saveable Ctx> \
+ *           unordered_group_range = bounded_context<unordered_group_context<Proj, Hash, Equiv, Ctx>>
+ *
+ *     :notation:
+ *         .. type:: peek_t = peek_element_t<Ctx>
+ *         .. type:: proj_t = safe_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *     :additional requirements:
+ *       `RandomAccessContext\<Ctx\> <RandomAccessContext>`
+ *
+ *       `Invokable\<meta::as_const\<Proj&\>, peek_t\> <Invokable>`
+ *
+ *       `Copyable\<optional\<proj_t\>\> <Copyable>`
+ *
+ *       `Invokable\<meta::as_const\<Hash&\>, meta::as_const\<proj_t&\>\> <Invokable>`
+ *
+ *       `Equivalence\<meta::as_const\<Equiv&\>, meta::as_const\<proj_t&\>, proj_t\> <Equivalence>`
+ */
+template<Variable Proj, Variable Hash, Variable Equiv, Saveable Ctx>
+using unordered_group_range = bounded_context<unordered_group_context<Proj, Hash, Equiv, Ctx>>;
+
+namespace impl {
+
+struct hash {
+    template<typename T>
+    std::size_t operator()(T const& t) const
+    { return std::hash<T> {}(t); }
+};
+
+} // impl
+
+namespace functors {
+
+/**
+ * .. var:: constexpr functors::group_unordered group_unordered
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Hash, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   unordered_group_range<Proj, Hash, Equiv, context_t<Rng>> \
+ *                   operator()(Proj&& proj, Hash&& hash, Equiv&& equiv, Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *             .. type:: peek_t = peek_element_t<Ctx>
+ *             .. type:: proj_t = safe_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *         Create a range over the equivalence classes induced by *proj* and *equiv* over the elements of *rng*, in
+ *         order of first appearance. Unlike with `group` the elements need not be sorted: they are bucketed according
+ *         to the hashes of their criteria, in a single pass. *hash* must give the same result for equivalent criteria.
+ *
+ *         :param hash: Must satisfy `Invokable\<meta::as_const\<Hash&\>, meta::as_const\<proj_t&\>\> <Invokable>`,
+ *           with a result convertible to ``std::size_t``.
+ *         :param rng: `Saveable` `Range` with a `RandomAccessContext`. Additionally, ``proj_t`` must be a reference
+ *           type or model `Copyable`.
+ *         :models:
+ *           `Range` with the following |range-properties|:
+ *
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Element    | a subrange, see below                                                               |
+ *           | types      |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Traversal  | `RandomAccessContext`                                                               |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Saveable   | yes                                                                                 |
+ *           |            |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *
+ *           The subrange is a `RandomAccessContext` `Range` with the same element types as `Ctx`, which elements are
+ *           in the same order as in *rng*. It refers to the storage of the range it comes from, which must outlive it.
+ *         :additional construction complexity:
+ *           Linear time on average with respect to the number of elements of *rng*.
+ *         :additional construction effects:
+ *           Allocates storage for the offset of each element, plus storage proportional to the number of classes.
+ *           The bookkeeping needed while bucketing comes from a single arena that is released before returning.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   unordered_group_range<functors::forward, impl::hash, functors::equal_to, context_t<Rng>> \
+ *                   operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, impl::hash {}, functors::equal_to {}, std::move(rng))
+ *         <operator()>`, where `impl::hash` uses ``std::hash``.
+ */
+struct group_unordered: impl::range_function<group_unordered> {
+    template<ForwardableType Proj, ForwardableType Hash, ForwardableType Equiv, MoveConstructible Rng>
+    unordered_group_range<Proj, Hash, Equiv, context_t<Rng>>
+    operator()(Proj&& proj, Hash&& hash, Equiv&& equiv, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    {
+        auto&& [ctx, from, to] = rng;
+
+        auto const length = range::distance(ctx, from, to);
+        unordered_group_context<Proj, Hash, Equiv, context_t<Rng>> result {
+            std::move(ctx), std::move(from), as_const(proj), as_const(hash), as_const(equiv), length
+        };
+        std::size_t const count = result.class_starts.size() - 1;
+        return { std::move(result), 0, count };
+    }
+
+    MoveConstructible{Rng}
+    unordered_group_range<functors::forward, impl::hash, functors::equal_to, context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return (*this)(functors::forward {}, impl::hash {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::group_by_unordered group_by_unordered
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, MoveConstructible Rng> \
+ *                   unordered_group_range<Proj, impl::hash, functors::equal_to, context_t<Rng>> \
+ *                   operator()(Proj&& proj, Rng rng) const
+ *
+ *         Equivalent to `group_unordered(std::forward\<Proj\>(proj), impl::hash {}, functors::equal_to {},
+ *         std::move(rng)) <group_unordered::operator()>`.
+ */
+struct group_by_unordered: impl::range_function<group_by_unordered> {
+    template<ForwardableType Proj, MoveConstructible Rng>
+    unordered_group_range<Proj, impl::hash, functors::equal_to, context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return group_unordered {}(std::forward<Proj>(proj), impl::hash {}, functors::equal_to {}, std::move(rng)); }
+};
+} // functors
+
+inline constexpr functors::group_unordered group_unordered {};
+inline constexpr functors::group_by_unordered group_by_unordered {};
+
+namespace result_of {
+Types{... Args} using group_unordered    = decltype( range::group_unordered(std::declval<Args>()...) );
+Types{... Args} using group_by_unordered = decltype( range::group_by_unordered(std::declval<Args>()...) );
+} // result_of
+
+} // annex::range
+
+#endif /* ANNEX_RANGE_TRANSFORMATION_GROUP_UNORDERED_HPP_INCLUDED */
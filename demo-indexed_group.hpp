@@ -0,0 +1,301 @@
+#ifndef ANNEX_RANGE_TRANSFORMATION_INDEXED_GROUP_HPP_INCLUDED
+#define ANNEX_RANGE_TRANSFORMATION_INDEXED_GROUP_HPP_INCLUDED
+
+#include "annex/range/transformation/group.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace annex::range {
+
+namespace functors { struct indexed_group; struct parallel_group; }
+
+template<Saveable Ctx>
+    requires RandomAccessContext<Ctx>
+struct indexed_group_context {
+    Ctx grouped_context;
+
+private:
+    friend functors::parallel_group;
+    friend functors::indexed_group;
+    position_t<Ctx> start;
+    // offset of the first element of each grouping, followed by the number of elements
+    std::vector<difference_t<Ctx>> boundaries;
+
+    indexed_group_context(Ctx ctx, position_t<Ctx> start, std::vector<difference_t<Ctx>> boundaries)
+        : grouped_context(std::forward<Ctx>(ctx))
+        , start(std::move(start))
+        , boundaries(std::move(boundaries))
+    {}
+
+    position_t<Ctx> nth(difference_t<Ctx> n)
+    {
+        auto result = start;
+        range::advance(grouped_context, result, n);
+        return result;
+    }
+
+public:
+    using position_type = std::size_t;
+
+    bool equal_pos(position_type x, position_type y)
+    { return x == y; }
+
+    bounded_context<Ctx> at(position_type pos)
+    { return { grouped_context, nth(boundaries[pos]), nth(boundaries[pos + 1]) }; }
+
+    void incr(position_type& pos)
+    { ++pos; }
+
+    void decr(position_type& pos)
+    { --pos; }
+
+    void advance(position_type& pos, std::ptrdiff_t n)
+    { pos += n; }
+
+    std::ptrdiff_t distance(position_type x, position_type y)
+    { return static_cast<std::ptrdiff_t>(y) - static_cast<std::ptrdiff_t>(x); }
+};
+
+/**
+ * .. type:: template<Saveable Ctx> indexed_group_range = bounded_context<indexed_group_context<Ctx>>
+ *
+ *     A range over groupings which positions have all been computed beforehand, as returned by `indexed_group` or
+ *     `parallel_group`. It is a `RandomAccessContext` `Range`, and in particular the number of its groupings can
+ *     be obtained in constant time by taking the distance between its first and last positions. A position is the
+ *     index of a grouping, and one offset into *ctx* is stored per grouping.
+ *
+ *     :additional requirements:
+ *       `RandomAccessContext\<Ctx\> <RandomAccessContext>`
+ */
+template<Saveable Ctx>
+using indexed_group_range = bounded_context<indexed_group_context<Ctx>>;
+
+namespace impl {
+
+// offsets within [first, last) of the elements that start a grouping, where first is strictly positive
+template<typename Proj, typename Equiv, typename Ctx>
+std::vector<difference_t<Ctx>> find_group_boundaries(Proj const& proj, Equiv const& equiv, Ctx ctx, position_t<Ctx> pos,
+                                                     difference_t<Ctx> first, difference_t<Ctx> last)
+{
+    std::vector<difference_t<Ctx>> boundaries;
+
+    // the criterion of the grouping the element before first belongs to, since any element of a grouping is as good as
+    // its first when equivalence is concerned
+    range::advance(ctx, pos, first - 1);
+    optional<criterion_t<Proj, Ctx>> criterion { invoke(proj, range::peek_at(ctx, pos)) };
+    for(auto offset = first; offset != last; ++offset) {
+        range::incr(ctx, pos);
+        // the element is held for as long as its criterion is looked at, in case it is returned by value
+        auto&& element = range::peek_at(ctx, pos);
+        auto&& candidate = invoke(proj, std::forward<decltype(element)>(element));
+        if(!invoke(equiv, as_const(*criterion), as_const(candidate))) {
+            boundaries.push_back(offset);
+            criterion.emplace(std::forward<decltype(candidate)>(candidate));
+        }
+    }
+
+    return boundaries;
+}
+
+} // impl
+
+namespace functors {
+
+/**
+ * .. var:: constexpr functors::indexed_group indexed_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         Compute the same groupings as `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv),
+ *         std::move(rng)) <group::operator()>` all at once, so that they can be accessed in any order in constant time
+ *         afterwards. Neither *proj* nor *equiv* are part of the result.
+ *
+ *         :param rng: `Saveable` `Range` with a `RandomAccessContext`.
+ *         :additional construction complexity:
+ *           Linear time with respect to the number of elements of *rng*.
+ *         :additional construction effects:
+ *           Allocates storage for the position of each grouping.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   indexed_group_range<context_t<Rng>> operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+struct indexed_group: impl::range_function<indexed_group> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    {
+        using Ctx = context_t<Rng>;
+        auto&& [ctx, from, to] = rng;
+
+        difference_t<Ctx> const length = range::distance(ctx, from, to);
+        std::vector<difference_t<Ctx>> boundaries { 0 };
+        if(length != 0) {
+            auto found = impl::find_group_boundaries(as_const(proj), as_const(equiv), ctx, from, 1, length);
+            boundaries.insert(boundaries.end(), found.begin(), found.end());
+            boundaries.push_back(length);
+        }
+
+        std::size_t const count = boundaries.size() - 1;
+        return { { std::move(ctx), std::move(from), std::move(boundaries) }, 0, count };
+    }
+
+    MoveConstructible{Rng}
+    indexed_group_range<context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::indexed_group_by indexed_group_by
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, MoveConstructible Rng> \
+ *                   indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+ *
+ *         Equivalent to `indexed_group(std::forward\<Proj\>(proj), functors::equal_to {}, std::move(rng))
+ *         <indexed_group::operator()>`.
+ */
+struct indexed_group_by: impl::range_function<indexed_group_by> {
+    template<ForwardableType Proj, MoveConstructible Rng>
+    indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return indexed_group {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::parallel_group parallel_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *
+ *         Compute the same groupings as `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv),
+ *         std::move(rng)) <group::operator()>`, splitting the work across several threads. *rng* is cut into as many
+ *         chunks as there are hardware threads, within the limit of one chunk per `min_chunk_length` elements. Each
+ *         chunk is then searched for the starts of groupings concurrently, by comparing each element to those that
+ *         precede it. This works regardless of where the chunks are cut since *equiv* is an equivalence.
+ *
+ *         The result is an `indexed_group_range` which elements are the same subranges as those of `group`. *proj* and
+ *         *equiv* are used from several threads at once, through ``const`` references only.
+ *
+ *         :param rng: `Saveable` `Range` with a `RandomAccessContext`, which context is copied once per chunk.
+ *         :additional construction complexity:
+ *           Linear time with respect to the number of elements of *rng*, divided by the number of chunks.
+ *         :additional construction effects:
+ *           Allocates storage for the position of each grouping. Exceptions thrown by *proj* or *equiv* are
+ *           propagated once all chunks are done with.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   indexed_group_range<context_t<Rng>> operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ *
+ *     .. member:: static constexpr std::size_t min_chunk_length
+ *
+ *         The least number of elements worth handing over to another thread.
+ */
+struct parallel_group: impl::range_function<parallel_group> {
+    static constexpr std::size_t min_chunk_length = 1 << 14;
+
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    {
+        using Ctx = context_t<Rng>;
+        auto&& [ctx, from, to] = rng;
+
+        difference_t<Ctx> const length = range::distance(ctx, from, to);
+        std::vector<difference_t<Ctx>> boundaries;
+        if(length == 0) {
+            boundaries.push_back(0);
+            return { { std::move(ctx), std::move(from), std::move(boundaries) }, 0, 0 };
+        }
+
+        auto const chunk_count = std::clamp<difference_t<Ctx>>(length / difference_t<Ctx> { min_chunk_length },
+                                                               1, std::max(std::thread::hardware_concurrency(), 1u));
+        auto const chunk_start = [&](difference_t<Ctx> chunk) { return 1 + (length - 1) * chunk / chunk_count; };
+
+        // the first chunk is taken care of by the calling thread
+        std::vector<std::future<std::vector<difference_t<Ctx>>>> chunks;
+        for(difference_t<Ctx> chunk = 1; chunk != chunk_count; ++chunk) {
+            chunks.push_back(std::async(std::launch::async, [&proj, &equiv, &ctx = ctx, &from = from, &chunk_start, chunk] {
+                return impl::find_group_boundaries(as_const(proj), as_const(equiv), ctx, from,
+                                                   chunk_start(chunk), chunk_start(chunk + 1));
+            }));
+        }
+
+        // N.B. the futures wait for their chunk on destruction, even when unwinding
+        boundaries.push_back(0);
+        auto first = impl::find_group_boundaries(as_const(proj), as_const(equiv), ctx, from,
+                                                 chunk_start(0), chunk_start(1));
+        boundaries.insert(boundaries.end(), first.begin(), first.end());
+        for(auto& chunk: chunks) {
+            auto found = chunk.get();
+            boundaries.insert(boundaries.end(), found.begin(), found.end());
+        }
+        boundaries.push_back(length);
+
+        std::size_t const count = boundaries.size() - 1;
+        return { { std::move(ctx), std::move(from), std::move(boundaries) }, 0, count };
+    }
+
+    MoveConstructible{Rng}
+    indexed_group_range<context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::parallel_group_by parallel_group_by
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, MoveConstructible Rng> \
+ *                   indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+ *
+ *         Equivalent to `parallel_group(std::forward\<Proj\>(proj), functors::equal_to {}, std::move(rng))
+ *         <parallel_group::operator()>`.
+ */
+struct parallel_group_by: impl::range_function<parallel_group_by> {
+    template<ForwardableType Proj, MoveConstructible Rng>
+    indexed_group_range<context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return parallel_group {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(rng)); }
+};
+
+} // functors
+
+inline constexpr functors::indexed_group indexed_group {};
+inline constexpr functors::indexed_group_by indexed_group_by {};
+inline constexpr functors::parallel_group parallel_group {};
+inline constexpr functors::parallel_group_by parallel_group_by {};
+
+namespace result_of {
+Types{... Args} using indexed_group     = decltype( range::indexed_group(std::declval<Args>()...) );
+Types{... Args} using indexed_group_by  = decltype( range::indexed_group_by(std::declval<Args>()...) );
+Types{... Args} using parallel_group    = decltype( range::parallel_group(std::declval<Args>()...) );
+Types{... Args} using parallel_group_by = decltype( range::parallel_group_by(std::declval<Args>()...) );
+} // result_of
+
+} // annex::range
+
+#endif /* ANNEX_RANGE_TRANSFORMATION_INDEXED_GROUP_HPP_INCLUDED */
@@ -0,0 +1,245 @@
+#ifndef ANNEX_RANGE_TRANSFORMATION_RLE_HPP_INCLUDED
+#define ANNEX_RANGE_TRANSFORMATION_RLE_HPP_INCLUDED
+
+#include "annex/range/transformation/group.hpp"
+
+#include <cstddef>
+#include <utility>
+
+namespace annex::range {
+
+namespace functors { struct rle_expand; }
+
+namespace impl {
+
+struct count_elements {
+    template<typename Element>
+    constexpr std::size_t operator()(std::size_t count, Element&&) const
+    { return count + 1; }
+};
+
+} // impl
+
+/**
+ * .. type:: template<Saveable Ctx> \
+ *           rle_range = group_reduce_range<functors::forward, functors::equal_to, std::size_t, unspecified, Ctx>
+ *
+ *     :additional requirements:
+ *       Those of `group_reduce_range`
+ */
+template<Saveable Ctx>
+using rle_range = group_reduce_range<functors::forward, functors::equal_to, std::size_t, impl::count_elements, Ctx>;
+
+template<Saveable Ctx>
+    requires requires(peek_element_t<Ctx> run) {
+        std::get<0>(std::forward<peek_element_t<Ctx>>(run));
+        std::size_t(std::get<1>(std::forward<peek_element_t<Ctx>>(run)));
+    }
+struct rle_expand_context {
+    Ctx expanded_context;
+
+private:
+    friend functors::rle_expand;
+    sentinel_t<Ctx> end;
+
+    constexpr rle_expand_context(Ctx ctx, sentinel_t<Ctx> end)
+        : expanded_context(std::forward<Ctx>(ctx))
+        , end(std::move(end))
+    {}
+
+public:
+    struct position_type {
+    private:
+        friend functors::rle_expand;
+        friend rle_expand_context;
+
+        // the run the element belongs to, and its index within that run
+        position_t<Ctx> run;
+        std::size_t index;
+
+        constexpr position_type(position_t<Ctx> run, std::size_t index)
+            : run(std::move(run))
+            , index(index)
+        {}
+    };
+
+    struct sentinel_type: private impl::move_only_position_unless<meta::bool_<Copyable<sentinel_t<Ctx>>>> {
+    private:
+        friend functors::rle_expand;
+        friend rle_expand_context;
+        constexpr sentinel_type() = default;
+    };
+
+private:
+    constexpr std::size_t count(position_t<Ctx> const& run)
+    { return std::size_t(std::get<1>(range::peek_at(expanded_context, run))); }
+
+    // runs of no element have nothing to expand to, and are never pointed to by a position
+    constexpr void skip_empty_runs(position_t<Ctx>& run)
+    {
+        while(!range::equal_pos(expanded_context, run, end) && count(run) == 0) {
+            range::incr(expanded_context, run);
+        }
+    }
+
+public:
+    constexpr bool equal_pos(position_type const& x, position_type const& y)
+    { return range::equal_pos(expanded_context, x.run, y.run) && x.index == y.index; }
+    constexpr bool equal_pos(position_type const& x, sentinel_type const&)
+    { return range::equal_pos(expanded_context, x.run, end); }
+    constexpr bool equal_pos(sentinel_type const&, sentinel_type const&)
+    { return true; }
+
+    constexpr safe_t<decltype(std::get<0>(std::declval<peek_element_t<Ctx>>()))> at(position_type const& pos)
+    { return std::get<0>(range::peek_at(expanded_context, pos.run)); }
+
+    constexpr void incr(position_type& pos)
+    {
+        if(++pos.index == count(pos.run)) {
+            range::incr(expanded_context, pos.run);
+            skip_empty_runs(pos.run);
+            pos.index = 0;
+        }
+    }
+};
+
+/**
+ * .. type:: template<Saveable Ctx> \
+ *           rle_expand_range = bounded_context<rle_expand_context<Ctx>>
+ *
+ *     :notation:
+ *         .. type:: peek_t = peek_element_t<Ctx>
+ *
+ *     :requirements:
+ *       ``std::get<0>(std::declval<peek_t>())`` must be well-formed, and ``std::get<1>(std::declval<peek_t>())``
+ *       convertible to ``std::size_t``
+ */
+template<Saveable Ctx>
+using rle_expand_range = bounded_context<rle_expand_context<Ctx>>;
+
+namespace functors {
+
+/**
+ * .. var:: constexpr functors::rle rle
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<MoveConstructible Rng> \
+ *                   constexpr rle_range<context_t<Rng>> operator()(Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *             .. type:: peek_t = peek_element_t<Ctx>
+ *
+ *         Create a range over the run-length encoding of *rng*, that is to say over pairs of an element of *rng* and
+ *         of the number of consecutive elements that compare equal to it::
+ *
+ *             std::vector<char> column { 'a', 'a', 'a', 'b', 'c', 'c' };
+ *             // ('a', 3), ('b', 1), ('c', 2)
+ *             auto runs = rle(column);
+ *
+ *         The lengths are counted while looking for the end of each run, with no subrange being created and walked a
+ *         second time. The result of `rle_expand` over the result is a range over the same elements as *rng*.
+ *
+ *         Equivalent to `group_reduce(functors::forward {}, functors::equal_to {}, std::size_t { 0 }, op,
+ *         std::move(rng)) <group_reduce::operator()>` where *op* returns its first argument plus one.
+ *
+ *         :param rng: `Saveable` `Range`. Additionally, ``peek_t`` must be a reference type or model `Copyable`.
+ *         :models:
+ *           `Range` with the following |range-properties|:
+ *
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Element    | ``std::pair<safe_t<peek_t>, std::size_t> const&``                                   |
+ *           | types      |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Traversal  | `MultipassContext`                                                                  |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Saveable   | yes                                                                                 |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *         :additional construction complexity:
+ *           Linear time with respect to the length of the first run.
+ */
+struct rle: impl::range_function<rle> {
+    template<MoveConstructible Rng>
+    constexpr rle_range<context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng>
+    {
+        return group_reduce {}(functors::forward {}, functors::equal_to {}, std::size_t { 0 }, impl::count_elements {},
+                               std::move(rng));
+    }
+};
+
+/**
+ * .. var:: constexpr functors::rle_expand rle_expand
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<MoveConstructible Rng> \
+ *                   constexpr rle_expand_range<context_t<Rng>> operator()(Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *             .. type:: peek_t = peek_element_t<Ctx>
+ *             .. type:: value_t = safe_t<decltype(std::get<0>(std::declval<peek_t>()))>
+ *
+ *         Create a range over the decoding of the run-length encoding *rng*, where each element of *rng* is a pair of
+ *         a value and of the number of times it is repeated, in the manner of the result of `rle`::
+ *
+ *             std::vector<std::pair<char, int>> runs { { 'a', 3 }, { 'b', 1 }, { 'c', 2 } };
+ *             // 'a', 'a', 'a', 'b', 'c', 'c'
+ *             auto column = rle_expand(runs);
+ *
+ *         Runs of length zero are skipped. Each run is only accessed as its elements are traversed, and no storage is
+ *         allocated.
+ *
+ *         :param rng: `Saveable` `Range` of which the elements are as described by `rle_expand_range`.
+ *         :models:
+ *           `Range` with the following |range-properties|:
+ *
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Element    | ``value_t``                                                                         |
+ *           | types      |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Traversal  | `MultipassContext`                                                                  |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Saveable   | yes                                                                                 |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *         :additional construction complexity:
+ *           Linear time with respect to the number of leading runs of length zero.
+ *         :simple context members:
+ *           ``expanded_context``: *ctx*
+ */
+struct rle_expand: impl::range_function<rle_expand> {
+    template<MoveConstructible Rng>
+    constexpr rle_expand_range<context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng>
+    {
+        auto&& [ctx, from, to] = rng;
+
+        rle_expand_range<context_t<Rng>> result {
+            { std::move(ctx), std::move(to) },
+            { std::move(from), 0 },
+            {},
+        };
+        result.context.skip_empty_runs(result.from.run);
+        return result;
+    }
+};
+
+} // functors
+
+inline constexpr functors::rle rle {};
+inline constexpr functors::rle_expand rle_expand {};
+
+namespace result_of {
+Types{... Args} using rle        = decltype( range::rle(std::declval<Args>()...) );
+Types{... Args} using rle_expand = decltype( range::rle_expand(std::declval<Args>()...) );
+} // result_of
+
+} // annex::range
+
+#endif /* ANNEX_RANGE_TRANSFORMATION_RLE_HPP_INCLUDED */
@@ -0,0 +1,409 @@
+#ifndef ANNEX_RANGE_TRANSFORMATION_STREAM_GROUP_HPP_INCLUDED
+#define ANNEX_RANGE_TRANSFORMATION_STREAM_GROUP_HPP_INCLUDED
+
+#include "annex/range/transformation/group.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace annex::range {
+
+namespace functors { struct stream_group; template<MoveConstructible T> struct incremental_group; }
+
+template<Variable Proj, Variable Equiv, Context Ctx>
+    requires impl::StreamGroupable<Proj, Equiv, peek_element_t<Ctx>>
+struct stream_group_context;
+
+template<Variable Proj, Variable Equiv, Context Ctx>
+struct stream_grouping_context {
+private:
+    friend stream_group_context<Proj, Equiv, Ctx>;
+    stream_group_context<Proj, Equiv, Ctx>* group;
+
+    constexpr explicit stream_grouping_context(stream_group_context<Proj, Equiv, Ctx>& group)
+        : group(&group)
+    {}
+
+public:
+    struct position_type: private impl::move_only_position_unless<meta::bool_<false>> {
+    private:
+        friend stream_group_context<Proj, Equiv, Ctx>;
+        constexpr position_type() = default;
+    };
+
+    struct sentinel_type {
+    private:
+        friend stream_group_context<Proj, Equiv, Ctx>;
+        constexpr sentinel_type() = default;
+    };
+
+    constexpr bool equal_pos(position_type const&, position_type const&)
+    { return true; }
+    constexpr bool equal_pos(position_type const&, sentinel_type const&)
+    { return group->grouping_done(); }
+    constexpr bool equal_pos(sentinel_type const&, sentinel_type const&)
+    { return true; }
+
+    constexpr decltype(auto) at(position_type const&)
+    { return range::at(group->grouped_context, group->cursor); }
+
+    constexpr void incr(position_type&)
+    {
+        range::incr(group->grouped_context, group->cursor);
+        group->cursor_checked = false;
+    }
+};
+
+template<Variable Proj, Variable Equiv, Context Ctx>
+    requires impl::StreamGroupable<Proj, Equiv, peek_element_t<Ctx>>
+struct stream_group_context {
+    Proj grouping_projection;
+    Equiv grouping_equivalence;
+    Ctx grouped_context;
+
+private:
+    friend functors::stream_group;
+    friend stream_grouping_context<Proj, Equiv, Ctx>;
+    // criteria are kept as values since the elements they come from need not outlive a traversal step
+    using criterion_type = impl::criterion_value_t<Proj, peek_element_t<Ctx>>;
+
+    // the one position into grouped_context that is ever used
+    position_t<Ctx> cursor;
+    sentinel_t<Ctx> end;
+    // of the current grouping, or empty past the last one
+    optional<criterion_type> criterion;
+    // the criterion of the element at cursor when it was found to start the next grouping
+    optional<criterion_type> lookahead;
+    bool cursor_checked = true;
+
+    constexpr stream_group_context(Proj proj, Equiv equiv, Ctx ctx, position_t<Ctx> cursor, sentinel_t<Ctx> end)
+        : grouping_projection(std::forward<Proj>(proj))
+        , grouping_equivalence(std::forward<Equiv>(equiv))
+        , grouped_context(std::forward<Ctx>(ctx))
+        , cursor(std::move(cursor))
+        , end(std::move(end))
+    {
+        if(!range::equal_pos(grouped_context, this->cursor, this->end)) {
+            criterion.emplace(invoke(as_const(grouping_projection), range::peek_at(grouped_context, this->cursor)));
+        }
+    }
+
+    constexpr bool grouping_done()
+    {
+        if(range::equal_pos(grouped_context, cursor, end)) {
+            return true;
+        }
+
+        if(!cursor_checked) {
+            lookahead.emplace(invoke(as_const(grouping_projection), range::peek_at(grouped_context, cursor)));
+            if(invoke(as_const(grouping_equivalence), as_const(*criterion), as_const(*lookahead))) {
+                lookahead.reset();
+            }
+            cursor_checked = true;
+        }
+        return bool(lookahead);
+    }
+
+public:
+    struct position_type: private impl::move_only_position_unless<meta::bool_<false>> {
+    private:
+        friend functors::stream_group;
+        constexpr position_type() = default;
+    };
+
+    struct sentinel_type {
+    private:
+        friend functors::stream_group;
+        constexpr sentinel_type() = default;
+    };
+
+    constexpr bool equal_pos(position_type const&, position_type const&)
+    { return true; }
+    constexpr bool equal_pos(position_type const&, sentinel_type const&)
+    { return !criterion; }
+    constexpr bool equal_pos(sentinel_type const&, sentinel_type const&)
+    { return true; }
+
+    constexpr bounded_context<stream_grouping_context<Proj, Equiv, Ctx>> at(position_type const&)
+    { return { stream_grouping_context<Proj, Equiv, Ctx> { *this }, {}, {} }; }
+
+    constexpr void incr(position_type&)
+    {
+        // skip what remains of the current grouping
+        while(!grouping_done()) {
+            range::incr(grouped_context, cursor);
+            cursor_checked = false;
+        }
+
+        if(lookahead) {
+            criterion.emplace(std::move(*lookahead));
+            lookahead.reset();
+        } else {
+            criterion.reset();
+        }
+    }
+};
+
+/**
+ * .. type:: template<Variable Proj, Variable Equiv, Context Ctx> \
+ *           stream_group_range = bounded_context<stream_group_context<Proj, Equiv, Ctx>>
+ *
+ *     :notation:
+ *         .. type:: peek_t = peek_element_t<Ctx>
+ *         .. type:: crit_t = std::decay_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *     :additional requirements:
+ *       `Invokable\<meta::as_const\<Proj&\>, peek_t\> <Invokable>`
+ *
+ *       `MoveConstructible\<crit_t\> <MoveConstructible>`
+ *
+ *       `Equivalence\<meta::as_const\<Equiv&\>, crit_t const&, crit_t const&\> <Equivalence>`
+ */
+template<Variable Proj, Variable Equiv, Context Ctx>
+using stream_group_range = bounded_context<stream_group_context<Proj, Equiv, Ctx>>;
+
+/**
+ * .. type:: template<Variable Proj, Variable Equiv, MoveConstructible T> group_accumulator
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     :notation:
+ *         .. type:: crit_t = std::decay_t<result<meta::as_const<Proj&>, T const&>>
+ *
+ *     :requirements:
+ *       `Invokable\<meta::as_const\<Proj&\>, T const&\> <Invokable>`
+ *
+ *       `MoveConstructible\<crit_t\> <MoveConstructible>`
+ *
+ *       `Equivalence\<meta::as_const\<Equiv&\>, crit_t const&, crit_t const&\> <Equivalence>`
+ *
+ *     Groups elements that are handed to it one at a time rather than read from a range, as returned by
+ *     `incremental_group`. It holds the grouping that is still open, and no more.
+ *
+ *     .. type:: grouping_type = std::pair<crit_t, std::vector<T>>
+ *
+ *         A completed grouping: its criterion, and its elements in the order they were pushed.
+ *
+ *     .. function:: optional<grouping_type> push(T element)
+ *
+ *         Add *element* to the open grouping if it is equivalent to it, otherwise close that grouping and return it,
+ *         *element* starting the next one. Invokes *proj* once and *equiv* at most once.
+ *
+ *     .. function:: optional<grouping_type> flush()
+ *
+ *         Close the open grouping and return it, if there is one. To be called once the elements run out.
+ *
+ *     .. function:: bool empty() const
+ *
+ *         Whether there is no open grouping.
+ */
+template<Variable Proj, Variable Equiv, MoveConstructible T>
+    requires impl::StreamGroupable<Proj, Equiv, T const&>
+struct group_accumulator {
+    Proj grouping_projection;
+    Equiv grouping_equivalence;
+
+    // the criterion is a copy since the element it was projected from is moved into the grouping
+    using criterion_type = impl::criterion_value_t<Proj, T const&>;
+    using grouping_type = std::pair<criterion_type, std::vector<T>>;
+
+private:
+    friend functors::incremental_group<T>;
+    optional<grouping_type> open;
+
+    constexpr group_accumulator(Proj proj, Equiv equiv)
+        : grouping_projection(std::forward<Proj>(proj))
+        , grouping_equivalence(std::forward<Equiv>(equiv))
+    {}
+
+public:
+    constexpr bool empty() const
+    { return !open; }
+
+    optional<grouping_type> push(T element)
+    {
+        criterion_type candidate = invoke(as_const(grouping_projection), as_const(element));
+        if(open && invoke(as_const(grouping_equivalence), as_const(open->first), as_const(candidate))) {
+            open->second.push_back(std::move(element));
+            return {};
+        }
+
+        auto completed = flush();
+        open.emplace(std::move(candidate), std::vector<T> {});
+        open->second.push_back(std::move(element));
+        return completed;
+    }
+
+    optional<grouping_type> flush()
+    {
+        optional<grouping_type> completed;
+        if(open) {
+            completed.emplace(std::move(*open));
+            open.reset();
+        }
+        return completed;
+    }
+};
+
+namespace functors {
+
+/**
+ * .. var:: constexpr functors::stream_group stream_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   constexpr stream_group_range<Proj, Equiv, context_t<Rng>> \
+ *                   operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *             .. type:: peek_t = peek_element_t<Ctx>
+ *             .. type:: crit_t = std::decay_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *         A variant of `group` for ranges that can only be traversed once, such as those reading from a file or a
+ *         socket. The groupings are the same, but each of them can only be traversed once and only while it is the
+ *         current grouping: incrementing the result skips what remains of the current grouping. The criterion of the
+ *         current grouping is kept as a ``crit_t`` value inside the context of the result, so that the groupings of an
+ *         unbounded range can be traversed in constant space.
+ *
+ *         :param rng: `Range`, which need not be `Saveable`.
+ *         :models:
+ *           `Range` with the following |range-properties|:
+ *
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Element    | a subrange, see below                                                               |
+ *           | types      |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Traversal  | single pass                                                                         |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Saveable   | no                                                                                  |
+ *           |            |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *
+ *           The subrange is a single pass `Range` with the same element types as `Ctx`. It refers to the context of
+ *           the result, which must outlive it.
+ *         :additional construction complexity:
+ *           Constant time.
+ *         :simple context members:
+ *           ``grouping_projection``: *proj*
+ *
+ *           ``grouping_equivalence``: *equiv*
+ *
+ *           ``grouped_context``: *ctx*
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   constexpr stream_group_range<functors::forward, functors::equal_to, context_t<Rng>> \
+ *                   operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+struct stream_group: impl::range_function<stream_group> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    constexpr stream_group_range<Proj, Equiv, context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng>
+    {
+        auto&& [ctx, from, to] = rng;
+
+        return {
+            { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), std::move(from), std::move(to) },
+            {},
+            {},
+        };
+    }
+
+    MoveConstructible{Rng}
+    constexpr stream_group_range<functors::forward, functors::equal_to, context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::stream_group_by stream_group_by
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, MoveConstructible Rng> \
+ *                   constexpr stream_group_range<Proj, functors::equal_to, context_t<Rng>> \
+ *                   operator()(Proj&& proj, Rng rng) const
+ *
+ *         Equivalent to `stream_group(std::forward\<Proj\>(proj), functors::equal_to {}, std::move(rng))
+ *         <stream_group::operator()>`.
+ */
+struct stream_group_by: impl::range_function<stream_group_by> {
+    template<ForwardableType Proj, MoveConstructible Rng>
+    constexpr stream_group_range<Proj, functors::equal_to, context_t<Rng>> operator()(Proj&& proj, Rng rng) const
+        requires Range<Rng>
+    { return stream_group {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: template<MoveConstructible T> constexpr functors::incremental_group<T> incremental_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv> \
+ *                   constexpr group_accumulator<Proj, Equiv, T> operator()(Proj&& proj, Equiv&& equiv) const
+ *
+ *         A variant of `stream_group` for when the elements are pushed by a producer instead of being pulled from a
+ *         range, e.g. as batches arrive from an asynchronous source. The groupings are the same as those of `group`
+ *         over all the elements pushed, regardless of how they were split in batches: a grouping that is still open at
+ *         the end of a batch carries over to the next one. Each grouping is returned as soon as the first element past
+ *         it is pushed, which from a coroutine makes for::
+ *
+ *             auto groupings = incremental_group<record>(&record::key, std::equal_to<> {});
+ *             while(auto batch = co_await producer.next()) {
+ *                 for(auto& element: *batch) {
+ *                     if(auto grouping = groupings.push(std::move(element))) {
+ *                         co_yield std::move(*grouping);
+ *                     }
+ *                 }
+ *             }
+ *             if(auto last = groupings.flush()) {
+ *                 co_yield std::move(*last);
+ *             }
+ *
+ *         Only the open grouping is kept, in a ``std::vector<T>``.
+ *
+ *     .. function:: constexpr group_accumulator<functors::forward, functors::equal_to, T> operator()() const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}) <operator()>`.
+ *
+ *     .. function:: template<ForwardableType Proj> \
+ *                   constexpr group_accumulator<Proj, functors::equal_to, T> operator()(Proj&& proj) const
+ *
+ *         Equivalent to `operator()(std::forward\<Proj\>(proj), functors::equal_to {}) <operator()>`.
+ */
+template<MoveConstructible T>
+struct incremental_group {
+    template<ForwardableType Proj, ForwardableType Equiv>
+    constexpr group_accumulator<Proj, Equiv, T> operator()(Proj&& proj, Equiv&& equiv) const
+    { return { std::forward<Proj>(proj), std::forward<Equiv>(equiv) }; }
+
+    constexpr group_accumulator<functors::forward, functors::equal_to, T> operator()() const
+    { return (*this)(functors::forward {}, functors::equal_to {}); }
+
+    template<ForwardableType Proj>
+    constexpr group_accumulator<Proj, functors::equal_to, T> operator()(Proj&& proj) const
+    { return (*this)(std::forward<Proj>(proj), functors::equal_to {}); }
+};
+
+} // functors
+
+inline constexpr functors::stream_group stream_group {};
+inline constexpr functors::stream_group_by stream_group_by {};
+template<MoveConstructible T> inline constexpr functors::incremental_group<T> incremental_group {};
+
+namespace result_of {
+Types{... Args} using stream_group    = decltype( range::stream_group(std::declval<Args>()...) );
+Types{... Args} using stream_group_by = decltype( range::stream_group_by(std::declval<Args>()...) );
+template<MoveConstructible T, typename... Args>
+using incremental_group = decltype( range::incremental_group<T>(std::declval<Args>()...) );
+} // result_of
+
+} // annex::range
+
+#endif /* ANNEX_RANGE_TRANSFORMATION_STREAM_GROUP_HPP_INCLUDED */
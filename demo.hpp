@@ -5,16 +5,292 @@
 #include "annex/data/optional/optional.hpp"
 #include "annex/range/range.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// the vectorised scan is written with GCC vector extensions and builtins, so that it costs no intrinsics header
+#if defined(__GNUC__) && defined(__x86_64__)
+#  define ANNEX_RANGE_GROUP_SIMD 1
+#else
+#  define ANNEX_RANGE_GROUP_SIMD 0
+#endif
+
 namespace annex::range {
 
-namespace functors { struct group; }
+namespace functors { struct group; struct lazy_group; struct group_sorted; struct group_reduce; }
+
+/**
+ * .. type:: group_search::linear
+ *           group_search::galloping
+ *
+ *     Strategies to look for the end of a grouping, for use as the ``Search`` parameter of `group_range`. With
+ *     `linear` every element of a grouping is examined in turn. With `galloping`, which requires a
+ *     `RandomAccessContext`, the elements that follow the start of a grouping are examined at exponentially growing
+ *     distances until one that falls outside of the grouping is found, after which a binary search is performed. This
+ *     takes logarithmic time with respect to the length of the grouping, but is only correct when the elements are
+ *     sorted with respect to their criteria according to an ordering compatible with the equivalence.
+ */
+namespace group_search {
+
+struct linear {};
+struct galloping {};
+
+} // group_search
+
+namespace impl {
+
+// the result of projecting an element, or an element of Ctx, spelled once so that it is only computed once per
+// instantiation
+template<typename Proj, typename Element>
+using element_projection_t = result<meta::as_const<Proj&>, Element>;
+
+template<typename Proj, typename Ctx>
+using projection_t = element_projection_t<Proj, peek_element_t<Ctx>>;
+
+// the criterion of an element as kept by a position, which can only refer into that element when the element stays
+// around, i.e. when it is peeked by lvalue reference
+template<typename Proj, typename Ctx>
+using criterion_t = std::conditional_t<std::is_lvalue_reference_v<peek_element_t<Ctx>>,
+                                       safe_t<projection_t<Proj, Ctx>>,
+                                       std::decay_t<projection_t<Proj, Ctx>>>;
+
+// the criterion kept as a copy when the element it was projected from doesn't stay around
+template<typename Proj, typename Element>
+using criterion_value_t = std::decay_t<element_projection_t<Proj, Element>>;
+
+// requirements shared by the contexts that keep the criterion of a grouping
+template<typename Proj, typename Equiv, typename Ctx>
+concept bool Groupable =
+    Invokable<meta::as_const<Proj&>, peek_element_t<Ctx>>
+    && Copyable<optional<criterion_t<Proj, Ctx>>>
+    && Equivalence<meta::as_const<Equiv&>, meta::as_const<projection_t<Proj, Ctx>&>, projection_t<Proj, Ctx>>;
+
+// likewise for the contexts that keep a copy of the criterion, for elements of type Element
+template<typename Proj, typename Equiv, typename Element>
+concept bool StreamGroupable =
+    Invokable<meta::as_const<Proj&>, Element>
+    && MoveConstructible<criterion_value_t<Proj, Element>>
+    && Equivalence<meta::as_const<Equiv&>,
+                   criterion_value_t<Proj, Element> const&,
+                   criterion_value_t<Proj, Element> const&>;
+
+template<typename Search, typename Ctx>
+concept bool GroupSearch =
+    SameType<Search, group_search::linear>
+    || (SameType<Search, group_search::galloping> && RandomAccessContext<Ctx>);
+
+// assign rather than emplace where possible so that e.g. the buffer of a string criterion gets reused
+template<typename T, typename U>
+constexpr void store_criterion(optional<T>& criterion, U&& value)
+{
+    if constexpr(!std::is_reference_v<T> && std::is_assignable_v<T&, U&&>) {
+        if(criterion) {
+            *criterion = std::forward<U>(value);
+            return;
+        }
+    }
+    criterion.emplace(std::forward<U>(value));
+}
+
+// find the end of the prefix of [first, last) over which pred holds, knowing that it holds for first
+template<typename Diff, typename Pred>
+constexpr Diff gallop(Diff first, Diff last, Pred pred)
+{
+    Diff good = first, bad = last;
+    for(Diff step = 1; step < bad - good; step *= 2) {
+        if(!pred(good + step)) {
+            bad = good + step;
+            break;
+        }
+        good += step;
+    }
+
+    while(bad - good > 1) {
+        Diff const middle = good + (bad - good) / 2;
+        if(pred(middle)) {
+            good = middle;
+        } else {
+            bad = middle;
+        }
+    }
+
+    return bad;
+}
+
+// elements for which the default projection & equivalence amount to comparing machine words -- extended integers such as
+// __int128 count as integral in GNU modes, but don't fit in one
+template<typename T>
+concept bool Scalar =
+    (std::is_integral_v<T> && sizeof(T) <= sizeof(std::int64_t))
+    || SameType<T, float>
+    || SameType<T, double>;
+
+template<typename Proj, typename Equiv, typename Ctx>
+concept bool ScalarGroupable =
+    SameType<std::decay_t<Proj>, functors::forward>
+    && SameType<std::decay_t<Equiv>, functors::equal_to>
+    && ContiguousContext<Ctx>
+    && std::is_lvalue_reference_v<peek_element_t<Ctx>>
+    && Scalar<std::decay_t<peek_element_t<Ctx>>>;
+
+template<Scalar T>
+constexpr T const* find_mismatch_scalar(T const* first, T const* last, T const& value)
+{
+    for(; first != last && *first == value; ++first) {}
+    return first;
+}
+
+#if ANNEX_RANGE_GROUP_SIMD
+
+// floating-point elements are compared lane by lane, and integers bytewise: the first differing byte always belongs to the
+// first differing element
+template<Scalar T>
+using lane_t = std::conditional_t<std::is_floating_point_v<T>, T, char>;
+
+template<Scalar T>
+inline void broadcast(void* block, std::size_t size, T const& value)
+{
+    for(std::size_t offset = 0; offset != size; offset += sizeof value) {
+        std::memcpy(static_cast<char*>(block) + offset, &value, sizeof value);
+    }
+}
+
+template<Scalar T>
+__attribute__((target("sse2")))
+inline T const* find_mismatch_sse2(T const* first, T const* last, T const& value)
+{
+    typedef lane_t<T> block_type __attribute__((vector_size(16)));
+    typedef char mask_type __attribute__((vector_size(16)));
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+
+    block_type pattern;
+    broadcast(&pattern, sizeof pattern, value);
+    for(; last - first >= lanes; first += lanes) {
+        block_type block;
+        std::memcpy(&block, first, sizeof block);
+        unsigned const mask = static_cast<unsigned>(__builtin_ia32_pmovmskb128((mask_type)(block == pattern)));
+        if(mask != 0xffffu) {
+            return first + __builtin_ctz(~mask) / sizeof(T);
+        }
+    }
+
+    return find_mismatch_scalar(first, last, value);
+}
+
+template<Scalar T>
+__attribute__((target("avx2")))
+inline T const* find_mismatch_avx2(T const* first, T const* last, T const& value)
+{
+    typedef lane_t<T> block_type __attribute__((vector_size(32)));
+    typedef char mask_type __attribute__((vector_size(32)));
+    constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+
+    block_type pattern;
+    broadcast(&pattern, sizeof pattern, value);
+    for(; last - first >= lanes; first += lanes) {
+        block_type block;
+        std::memcpy(&block, first, sizeof block);
+        unsigned const mask = static_cast<unsigned>(__builtin_ia32_pmovmskb256((mask_type)(block == pattern)));
+        if(mask != 0xffffffffu) {
+            return first + __builtin_ctz(~mask) / sizeof(T);
+        }
+    }
+
+    return find_mismatch_sse2(first, last, value);
+}
+
+inline bool has_avx2()
+{
+    static bool const result = __builtin_cpu_supports("avx2");
+    return result;
+}
+
+#endif
+
+// first element of [first, last) that doesn't compare equal to value
+template<Scalar T>
+constexpr T const* find_mismatch(T const* first, T const* last, T const& value)
+{
+#if ANNEX_RANGE_GROUP_SIMD
+    if(!__builtin_is_constant_evaluated()) {
+        return has_avx2() ? find_mismatch_avx2(first, last, value) : find_mismatch_sse2(first, last, value);
+    }
+#endif
+    return find_mismatch_scalar(first, last, value);
+}
+
+} // impl
 
-template<Variable Proj, Variable Equiv, Saveable Ctx>
+/**
+ * .. type:: group_statistics
+ *
+ *     Counts of the operations performed by a `group_range`, as returned by ``grouped.context.statistics()`` when
+ *     ``ANNEX_RANGE_GROUP_STATISTICS`` is defined before this header is first included. It must then be defined
+ *     likewise everywhere in the program. Otherwise no counting takes place, and ``statistics()`` is not available.
+ *
+ *     .. member:: std::size_t projections
+ *
+ *         Number of times the projection was invoked.
+ *
+ *     .. member:: std::size_t equivalences
+ *
+ *         Number of times the equivalence was invoked.
+ *
+ *     .. member:: std::size_t increments
+ *
+ *         Number of times a position of the grouped context was moved, in either direction and by any distance: a
+ *         skip made by a galloping or vectorised search counts once.
+ *
+ *     .. member:: std::size_t groupings
+ *
+ *         Number of times the end or the start of a grouping was looked for.
+ */
+struct group_statistics {
+    std::size_t projections = 0;
+    std::size_t equivalences = 0;
+    std::size_t increments = 0;
+    std::size_t groupings = 0;
+};
+
+namespace impl {
+
+#ifdef ANNEX_RANGE_GROUP_STATISTICS
+inline constexpr bool group_statistics_enabled = true;
+#else
+inline constexpr bool group_statistics_enabled = false;
+#endif
+
+template<bool Enabled>
+struct group_counters {
+    constexpr void projection() {}
+    constexpr void equivalence() {}
+    constexpr void increment() {}
+    constexpr void grouping() {}
+};
+
+template<>
+struct group_counters<true> {
+    group_statistics statistics;
+
+    constexpr void projection() { ++statistics.projections; }
+    constexpr void equivalence() { ++statistics.equivalences; }
+    constexpr void increment() { ++statistics.increments; }
+    constexpr void grouping() { ++statistics.groupings; }
+};
+
+} // impl
+
+template<Variable Proj, Variable Equiv, Saveable Ctx, typename Search = group_search::linear>
     requires
         SameType<position_t<Ctx>, sentinel_t<Ctx>>
-        && Invokable<meta::as_const<Proj&>, peek_element_t<Ctx>>
-        && Copyable<optional<safe_t<result<meta::as_const<Proj&>, peek_element_t<Ctx>>>>>
-        && Equivalence<meta::as_const<Equiv&>, meta::as_const<result<meta::as_const<Proj&>, peek_element_t<Ctx>>&>, result<meta::as_const<Proj&>, peek_element_t<Ctx>>>
+        && impl::Groupable<Proj, Equiv, Ctx>
+        && impl::GroupSearch<Search, Ctx>
 struct group_context {
     Proj grouping_projection;
     Equiv grouping_equivalence;
@@ -22,97 +298,177 @@ struct group_context {
 
 private:
     friend functors::group;
-    using criterion_type = safe_t<result<meta::as_const<Proj&>, peek_element_t<Ctx>>>;
+    friend functors::lazy_group;
+    friend functors::group_sorted;
+    using criterion_type = impl::criterion_t<Proj, Ctx>;
     sentinel_t<Ctx> end;
+    // the criterion of the element at lookahead_at, carried over from looking for the end of the last grouping so that
+    // no element is projected twice while keeping it out of the positions
+    position_t<Ctx> lookahead_at;
+    optional<criterion_type> lookahead;
+    // the end of the first grouping of a lazy_group once it has been looked for, the only position that can be pending
+    optional<position_t<Ctx>> first_stop;
+    [[no_unique_address]] impl::group_counters<impl::group_statistics_enabled> counters;
 
     constexpr group_context(Proj proj, Equiv equiv, Ctx ctx, sentinel_t<Ctx> end)
         : grouping_projection(std::forward<Proj>(proj))
         , grouping_equivalence(std::forward<Equiv>(equiv))
         , grouped_context(std::forward<Ctx>(ctx))
         , end(std::move(end))
+        , lookahead_at(this->end)
     {}
 
 public:
     struct position_type {
     private:
         friend functors::group;
+        friend functors::lazy_group;
         friend group_context;
 
+        // stop is left equal to start until the first position of a lazy_group is settled
         position_t<Ctx> start, stop;
-        optional<criterion_type> criterion;
 
-        constexpr position_type(position_t<Ctx> start, position_t<Ctx> stop, optional<criterion_type> criterion)
+        constexpr position_type(position_t<Ctx> start, position_t<Ctx> stop)
             : start(std::move(start))
             , stop(std::move(stop))
-            , criterion(std::move(criterion))
         {}
     };
 
     struct sentinel_type: private impl::move_only_position_unless<meta::bool_<Copyable<sentinel_t<Ctx>>>> {
     private:
         friend functors::group;
+        friend functors::lazy_group;
         friend group_context;
         constexpr sentinel_type() = default;
     };
 
+#ifdef ANNEX_RANGE_GROUP_STATISTICS
+    constexpr group_statistics const& statistics() const
+    { return counters.statistics; }
+#endif
+
 private:
-    constexpr bool equivalent(criterion_type& criterion, position_t<Ctx> const& pos)
+    // to be called on the element as peeked, within the same full expression or while a local holds the element, so
+    // that a criterion which refers into an element returned by value is only used while that element is around
+    template<typename Element>
+    constexpr decltype(auto) project(Element&& element)
+    {
+        counters.projection();
+        return invoke(as_const(grouping_projection), std::forward<Element>(element));
+    }
+
+    template<typename Candidate>
+    constexpr bool equivalent(criterion_type const& criterion, Candidate const& candidate)
     {
-        return invoke(as_const(grouping_equivalence), as_const(criterion),
-                      invoke(as_const(grouping_projection), range::peek_at(grouped_context, pos)) );
+        counters.equivalence();
+        return invoke(as_const(grouping_equivalence), as_const(criterion), candidate);
     }
 
-    constexpr position_t<Ctx> next_grouping(criterion_type& criterion, position_t<Ctx> pos)
+    constexpr void step(position_t<Ctx>& pos)
     {
+        counters.increment();
         range::incr(grouped_context, pos);
-        for(; !range::equal_pos(grouped_context, pos, end); range::incr(grouped_context, pos)) {
-            if(!equivalent(criterion, pos)) {
-                break;
+    }
+
+    // criterion is that of the element at pos on entry, and that of the element at the returned position on exit (or
+    // empty at the end) so that no element is projected twice
+    constexpr position_t<Ctx> next_grouping(optional<criterion_type>& criterion, position_t<Ctx> pos)
+    {
+        counters.grouping();
+        step(pos);
+        for(; !range::equal_pos(grouped_context, pos, end); step(pos)) {
+            // the element is held for as long as its criterion is looked at, in case it is returned by value
+            auto&& element = range::peek_at(grouped_context, pos);
+            auto&& candidate = project(std::forward<decltype(element)>(element));
+            if(!equivalent(*criterion, candidate)) {
+                impl::store_criterion(criterion, std::forward<decltype(candidate)>(candidate));
+                return pos;
             }
         }
 
+        criterion.reset();
         return pos;
     }
 
+    // an empty grouping that is not at the end can only be a first position that hasn't been looked at yet
+    constexpr bool pending(position_type const& pos)
+    { return range::equal_pos(grouped_context, pos.start, pos.stop) && !range::equal_pos(grouped_context, pos.stop, end); }
+
+    constexpr position_t<Ctx> stop_of(position_type const& pos)
+    {
+        if(!pending(pos)) {
+            return pos.stop;
+        }
+
+        if(!first_stop) {
+            look_ahead(pos.start);
+            first_stop.emplace(next_grouping(lookahead, pos.start));
+            lookahead_at = *first_stop;
+        }
+        return *first_stop;
+    }
+
+    constexpr void settle(position_type& pos)
+    { pos.stop = stop_of(pos); }
+
+    // the carried-over criterion is only reused at the position it was computed at, since positions can be moved in any
+    // order
+    constexpr void look_ahead(position_t<Ctx> const& pos)
+    {
+        if(!lookahead || !range::equal_pos(grouped_context, lookahead_at, pos)) {
+            impl::store_criterion(lookahead, project(range::peek_at(grouped_context, pos)));
+        }
+    }
+
 public:
+    // a grouping is determined by where it starts, whether its end has been looked for yet or not
     constexpr bool equal_pos(position_type const& x, position_type const& y)
-    { return range::equal_pos(grouped_context, x.start, y.start) && range::equal_pos(grouped_context, x.stop, y.stop); }
+    { return range::equal_pos(grouped_context, x.start, y.start); }
     constexpr bool equal_pos(position_type const& x, sentinel_type const&)
     { return range::equal_pos(grouped_context, x.start, end) && range::equal_pos(grouped_context, x.stop, end); }
     constexpr bool equal_pos(sentinel_type const&, sentinel_type const&)
     { return true; }
 
     constexpr bounded_context<Ctx> at(position_type const& pos)
-    { return { grouped_context, pos.start, pos.stop }; }
+    { return { grouped_context, pos.start, stop_of(pos) }; }
 
     constexpr void incr(position_type& pos)
     {
+        settle(pos);
         if(!range::equal_pos(grouped_context, pos.stop, end)) {
-            pos.criterion.emplace(range::peek_at(grouped_context, pos.stop));
-            pos.start = std::exchange(pos.stop, next_grouping(*pos.criterion, pos.stop));
+            look_ahead(pos.stop);
+            pos.start = std::exchange(pos.stop, next_grouping(lookahead, pos.stop));
+            lookahead_at = pos.stop;
         } else {
             pos.start = pos.stop;
         }
     }
 };
 
-template<Variable Proj, Variable Equiv, Context Ctx>
+template<Variable Proj, Variable Equiv, Context Ctx, typename Search>
     requires
         SameType<position_t<Ctx>, sentinel_t<Ctx>>
-        && Invokable<meta::as_const<Proj&>, peek_element_t<Ctx>>
-        && Copyable<optional<safe_t<result<meta::as_const<Proj&>, peek_element_t<Ctx>>>>>
-        && Equivalence<meta::as_const<Equiv&>, meta::as_const<result<meta::as_const<Proj&>, peek_element_t<Ctx>>&>, result<meta::as_const<Proj&>, peek_element_t<Ctx>>>
+        && impl::Groupable<Proj, Equiv, Ctx>
+        && impl::GroupSearch<Search, Ctx>
         && Saveable<Ctx>
         && BidirectionalContext<Ctx>
-struct group_context<Proj, Equiv, Ctx> {
+struct group_context<Proj, Equiv, Ctx, Search> {
     Proj grouping_projection;
     Equiv grouping_equivalence;
     Ctx grouped_context;
 
 private:
     friend functors::group;
-    using criterion_type = safe_t<result<meta::as_const<Proj&>, peek_element_t<Ctx>>>;
+    friend functors::lazy_group;
+    friend functors::group_sorted;
+    using criterion_type = impl::criterion_t<Proj, Ctx>;
     position_t<Ctx> start, end;
+    // see the primary template
+    position_t<Ctx> lookahead_at;
+    optional<criterion_type> lookahead;
+    // the end of the first grouping of a lazy_group once it has been looked for, the only position that can be pending
+    optional<position_t<Ctx>> first_stop;
+    [[no_unique_address]] impl::group_counters<impl::group_statistics_enabled> counters;
 
     constexpr group_context(Proj proj, Equiv equiv, Ctx ctx, position_t<Ctx> start, position_t<Ctx> end)
         : grouping_projection(std::forward<Proj>(proj))
@@ -120,75 +476,176 @@ private:
         , grouped_context(std::forward<Ctx>(ctx))
         , start(std::move(start))
         , end(std::move(end))
+        , lookahead_at(this->end)
     {}
 
 public:
     struct position_type {
     private:
         friend functors::group;
+        friend functors::lazy_group;
         friend group_context;
 
+        // stop is left equal to start until the first position of a lazy_group is settled
         position_t<Ctx> start, stop;
-        optional<criterion_type> criterion;
 
-        constexpr position_type(position_t<Ctx> start, position_t<Ctx> stop, optional<criterion_type> criterion)
+        constexpr position_type(position_t<Ctx> start, position_t<Ctx> stop)
             : start(std::move(start))
             , stop(std::move(stop))
-            , criterion(std::move(criterion))
         {}
     };
 
+#ifdef ANNEX_RANGE_GROUP_STATISTICS
+    constexpr group_statistics const& statistics() const
+    { return counters.statistics; }
+#endif
+
 private:
-    constexpr bool equivalent(criterion_type& criterion, position_t<Ctx> const& pos)
+    // see the primary template
+    template<typename Element>
+    constexpr decltype(auto) project(Element&& element)
     {
-        return invoke(as_const(grouping_equivalence), as_const(criterion),
-                      invoke(as_const(grouping_projection), range::peek_at(grouped_context, pos)) );
+        counters.projection();
+        return invoke(as_const(grouping_projection), std::forward<Element>(element));
     }
 
-    constexpr bool equivalent_before(criterion_type const& criterion, position_t<Ctx> const& pos)
+    template<typename Candidate>
+    constexpr bool equivalent(criterion_type const& criterion, Candidate const& candidate)
     {
-        return invoke(as_const(grouping_equivalence), criterion,
-                      invoke(as_const(grouping_projection), range::peek_before(grouped_context, pos)) );
+        counters.equivalence();
+        return invoke(as_const(grouping_equivalence), as_const(criterion), candidate);
     }
 
-    constexpr position_t<Ctx> next_grouping(criterion_type& criterion, position_t<Ctx> pos)
+    constexpr void step(position_t<Ctx>& pos)
     {
+        counters.increment();
         range::incr(grouped_context, pos);
-        for(; !range::equal_pos(grouped_context, pos, end); range::incr(grouped_context, pos)) {
-            if(!equivalent(criterion, pos)) {
-                break;
+    }
+
+    constexpr void step_back(position_t<Ctx>& pos)
+    {
+        counters.increment();
+        range::decr(grouped_context, pos);
+    }
+
+    constexpr void jump(position_t<Ctx>& pos, difference_t<Ctx> n)
+    {
+        counters.increment();
+        range::advance(grouped_context, pos, n);
+    }
+
+    // criterion is that of the element at pos on entry, and that of the element at the returned position on exit (or
+    // empty at the end) so that no element is projected twice by a linear search
+    constexpr position_t<Ctx> next_grouping(optional<criterion_type>& criterion, position_t<Ctx> pos)
+    {
+        counters.grouping();
+        if constexpr(SameType<Search, group_search::galloping>) {
+            auto const length = impl::gallop(difference_t<Ctx> { 0 }, range::distance(grouped_context, pos, end),
+                                             [&](difference_t<Ctx> offset) {
+                                                 auto probe = pos;
+                                                 jump(probe, offset);
+                                                 return equivalent(*criterion,
+                                                                   project(range::peek_at(grouped_context, probe)));
+                                             });
+            jump(pos, length);
+        } else if constexpr(impl::ScalarGroupable<Proj, Equiv, Ctx>) {
+            auto const* first = std::addressof(range::peek_at(grouped_context, pos));
+            auto const* last = first + range::distance(grouped_context, pos, end);
+            jump(pos, impl::find_mismatch(first + 1, last, *criterion) - first);
+        } else {
+            step(pos);
+            for(; !range::equal_pos(grouped_context, pos, end); step(pos)) {
+                // the element is held for as long as its criterion is looked at, in case it is returned by value
+                auto&& element = range::peek_at(grouped_context, pos);
+                auto&& candidate = project(std::forward<decltype(element)>(element));
+                if(!equivalent(*criterion, candidate)) {
+                    impl::store_criterion(criterion, std::forward<decltype(candidate)>(candidate));
+                    return pos;
+                }
             }
+
+            criterion.reset();
+            return pos;
         }
 
+        if(!range::equal_pos(grouped_context, pos, end)) {
+            impl::store_criterion(criterion, project(range::peek_at(grouped_context, pos)));
+        } else {
+            criterion.reset();
+        }
         return pos;
     }
 
     constexpr position_t<Ctx> prev_grouping(criterion_type& criterion, position_t<Ctx> pos)
     {
-        range::decr(grouped_context, pos);
-        for(; !range::equal_pos(grouped_context, start, pos); range::decr(grouped_context, pos)) {
-            if(!equivalent_before(criterion, pos)) {
-                break;
+        counters.grouping();
+        if constexpr(SameType<Search, group_search::galloping>) {
+            // offsets are counted backwards, the element at offset 1 being the one right before pos
+            auto const length = impl::gallop(difference_t<Ctx> { 1 }, range::distance(grouped_context, start, pos) + 1,
+                                             [&](difference_t<Ctx> offset) {
+                                                 auto probe = pos;
+                                                 jump(probe, 1 - offset);
+                                                 return equivalent(criterion,
+                                                                   project(range::peek_before(grouped_context, probe)));
+                                             }) - 1;
+            jump(pos, -length);
+        } else {
+            step_back(pos);
+            for(; !range::equal_pos(grouped_context, start, pos); step_back(pos)) {
+                if(!equivalent(criterion, project(range::peek_before(grouped_context, pos)))) {
+                    break;
+                }
             }
         }
 
         return pos;
     }
 
-public:
-    constexpr bool equal_pos(position_type const& x, position_type const& y)
+    // an empty grouping that is not at the end can only be a first position that hasn't been looked at yet
+    constexpr bool pending(position_type const& pos)
+    { return range::equal_pos(grouped_context, pos.start, pos.stop) && !range::equal_pos(grouped_context, pos.stop, end); }
+
+    constexpr position_t<Ctx> stop_of(position_type const& pos)
+    {
+        if(!pending(pos)) {
+            return pos.stop;
+        }
+
+        if(!first_stop) {
+            look_ahead(pos.start);
+            first_stop.emplace(next_grouping(lookahead, pos.start));
+            lookahead_at = *first_stop;
+        }
+        return *first_stop;
+    }
+
+    constexpr void settle(position_type& pos)
+    { pos.stop = stop_of(pos); }
+
+    // the carried-over criterion is only reused at the position it was computed at, since positions can be moved in any
+    // order
+    constexpr void look_ahead(position_t<Ctx> const& pos)
     {
-        return range::equal_pos(grouped_context, x.start, y.start) && range::equal_pos(grouped_context, x.stop, y.stop);
+        if(!lookahead || !range::equal_pos(grouped_context, lookahead_at, pos)) {
+            impl::store_criterion(lookahead, project(range::peek_at(grouped_context, pos)));
+        }
     }
 
+public:
+    // a grouping is determined by where it starts, whether its end has been looked for yet or not
+    constexpr bool equal_pos(position_type const& x, position_type const& y)
+    { return range::equal_pos(grouped_context, x.start, y.start); }
+
     constexpr bounded_context<Ctx> at(position_type const& pos)
-    { return { grouped_context, pos.start, pos.stop }; }
+    { return { grouped_context, pos.start, stop_of(pos) }; }
 
     constexpr void incr(position_type& pos)
     {
+        settle(pos);
         if(!range::equal_pos(grouped_context, pos.stop, end)) {
-            pos.criterion.emplace(range::peek_at(grouped_context, pos.stop));
-            pos.start = std::exchange(pos.stop, next_grouping(*pos.criterion, pos.stop));
+            look_ahead(pos.stop);
+            pos.start = std::exchange(pos.stop, next_grouping(lookahead, pos.stop));
+            lookahead_at = pos.stop;
         } else {
             pos.start = pos.stop;
         }
@@ -196,14 +653,14 @@ public:
 
     constexpr void decr(position_type& pos)
     {
-        pos.criterion.emplace(range::peek_before(grouped_context, pos.start));
-        pos.stop = std::exchange(pos.start, prev_grouping(*pos.criterion, pos.start));
+        criterion_type criterion = project(range::peek_before(grouped_context, pos.start));
+        pos.stop = std::exchange(pos.start, prev_grouping(criterion, pos.start));
     }
 };
 
 /**
- * .. type:: template<Variable Proj, Variable Equiv, Saveable Ctx> \
- *           group_range = bounded_context<group_context<Proj, Equiv, Ctx>>
+ * .. type:: template<Variable Proj, Variable Equiv, Saveable Ctx, typename Search = group_search::linear> \
+ *           group_range = bounded_context<group_context<Proj, Equiv, Ctx, Search>>
  *
  *     :notation:
  *         .. type:: peek_t = peek_element_t<Ctx>
@@ -217,12 +674,201 @@ public:
  *       `Copyable\<optional\<proj_t\>\> <Copyable>`
  *
  *       `Equivalence\<meta::as_const\<Equiv&\>, meta::as_const\<proj_t&\>, proj_t\> <Equivalence>`
+ *
+ *       ``Search`` is `group_search::linear`, or `group_search::galloping` and `RandomAccessContext\<Ctx\>
+ *       <RandomAccessContext>`
+ */
+template<Variable Proj, Variable Equiv, Saveable Ctx, typename Search = group_search::linear>
+using group_range = bounded_context<group_context<Proj, Equiv, Ctx, Search>>;
+
+template<Variable Proj, Variable Equiv, CopyConstructible T, Variable Op, Saveable Ctx>
+    requires
+        SameType<position_t<Ctx>, sentinel_t<Ctx>>
+        && impl::Groupable<Proj, Equiv, Ctx>
+        && Invokable<meta::as_const<Op&>, T, peek_element_t<Ctx>>
+        && SameType<result<meta::as_const<Op&>, T, peek_element_t<Ctx>>, T>
+struct group_reduce_context {
+    Proj grouping_projection;
+    Equiv grouping_equivalence;
+    T reduction_init;
+    Op reduction_operation;
+    Ctx grouped_context;
+
+private:
+    friend functors::group_reduce;
+    using criterion_type = impl::criterion_t<Proj, Ctx>;
+    sentinel_t<Ctx> end;
+
+    constexpr group_reduce_context(Proj proj, Equiv equiv, T init, Op op, Ctx ctx, sentinel_t<Ctx> end)
+        : grouping_projection(std::forward<Proj>(proj))
+        , grouping_equivalence(std::forward<Equiv>(equiv))
+        , reduction_init(std::move(init))
+        , reduction_operation(std::forward<Op>(op))
+        , grouped_context(std::forward<Ctx>(ctx))
+        , end(std::move(end))
+    {}
+
+public:
+    struct position_type {
+    private:
+        friend functors::group_reduce;
+        friend group_reduce_context;
+
+        // where the next grouping starts, the criterion of its first element once it has been projected, and the
+        // current grouping reduced unless past the last grouping
+        position_t<Ctx> next;
+        optional<criterion_type> lookahead;
+        optional<std::pair<criterion_type, T>> reduced;
+
+        constexpr position_type(position_t<Ctx> next, optional<criterion_type> lookahead,
+                                optional<std::pair<criterion_type, T>> reduced)
+            : next(std::move(next))
+            , lookahead(std::move(lookahead))
+            , reduced(std::move(reduced))
+        {}
+    };
+
+    struct sentinel_type: private impl::move_only_position_unless<meta::bool_<Copyable<sentinel_t<Ctx>>>> {
+    private:
+        friend functors::group_reduce;
+        friend group_reduce_context;
+        constexpr sentinel_type() = default;
+    };
+
+private:
+    // each element is peeked once, for both its criterion and its reduction, and the element that ends a grouping
+    // leaves its criterion behind for the next one
+    constexpr void reduce_grouping(position_type& pos)
+    {
+        {
+            auto&& element = range::peek_at(grouped_context, pos.next);
+            if(!pos.lookahead) {
+                pos.lookahead.emplace(invoke(as_const(grouping_projection), element));
+            }
+            pos.reduced.emplace(std::move(*pos.lookahead),
+                                invoke(as_const(reduction_operation), T(reduction_init),
+                                       std::forward<decltype(element)>(element)));
+            pos.lookahead.reset();
+        }
+        auto& [criterion, accumulated] = *pos.reduced;
+
+        range::incr(grouped_context, pos.next);
+        for(; !range::equal_pos(grouped_context, pos.next, end); range::incr(grouped_context, pos.next)) {
+            auto&& element = range::peek_at(grouped_context, pos.next);
+            auto&& candidate = invoke(as_const(grouping_projection), element);
+            if(!invoke(as_const(grouping_equivalence), as_const(criterion), as_const(candidate))) {
+                pos.lookahead.emplace(std::forward<decltype(candidate)>(candidate));
+                break;
+            }
+            accumulated = invoke(as_const(reduction_operation), std::move(accumulated),
+                                 std::forward<decltype(element)>(element));
+        }
+    }
+
+public:
+    constexpr bool equal_pos(position_type const& x, position_type const& y)
+    { return range::equal_pos(grouped_context, x.next, y.next) && bool(x.reduced) == bool(y.reduced); }
+    constexpr bool equal_pos(position_type const& x, sentinel_type const&)
+    { return !x.reduced; }
+    constexpr bool equal_pos(sentinel_type const&, sentinel_type const&)
+    { return true; }
+
+    constexpr std::pair<criterion_type, T> const& at(position_type const& pos)
+    { return *pos.reduced; }
+
+    constexpr void incr(position_type& pos)
+    {
+        if(!range::equal_pos(grouped_context, pos.next, end)) {
+            reduce_grouping(pos);
+        } else {
+            pos.reduced.reset();
+        }
+    }
+};
+
+/**
+ * .. type:: template<Variable Proj, Variable Equiv, CopyConstructible T, Variable Op, Saveable Ctx> \
+ *           group_reduce_range = bounded_context<group_reduce_context<Proj, Equiv, T, Op, Ctx>>
+ *
+ *     :notation:
+ *         .. type:: peek_t = peek_element_t<Ctx>
+ *         .. type:: proj_t = safe_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *     :additional requirements:
+ *       Those of `group_range`
+ *
+ *       `Invokable\<meta::as_const\<Op&\>, T, peek_t\> <Invokable>`
+ *
+ *       `SameType\<result\<meta::as_const\<Op&\>, T, peek_t\>, T\> <SameType>`
  */
-template<Variable Proj, Variable Equiv, Saveable Ctx>
-using group_range = bounded_context<group_context<Proj, Equiv, Ctx>>;
+template<Variable Proj, Variable Equiv, CopyConstructible T, Variable Op, Saveable Ctx>
+using group_reduce_range = bounded_context<group_reduce_context<Proj, Equiv, T, Op, Ctx>>;
 
 namespace functors {
 
+/**
+ * .. var:: constexpr functors::lazy_group lazy_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   constexpr group_range<Proj, Equiv, context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         A variant of `group` which does not look for the end of the first grouping until it is needed, i.e. until
+ *         the first position of the result is accessed or incremented. Otherwise equivalent to
+ *         `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv), std::move(rng)) <group::operator()>`.
+ *
+ *         The end of the first grouping is stored in the context of the result once it has been looked for, and not in
+ *         the first position. As a consequence accessing or incrementing that position modifies the context, even
+ *         though the position is accessed through a ``const`` reference: the result must not be traversed from several
+ *         threads at once without synchronisation.
+ *
+ *         :additional construction complexity:
+ *           Constant time.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   constexpr group_range<functors::forward, functors::equal_to, context_t<Rng>> operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+struct lazy_group: impl::range_function<lazy_group> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    constexpr group_range<Proj, Equiv, context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng>
+    { return make<group_search::linear>(std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(rng)); }
+
+    MoveConstructible{Rng}
+    constexpr group_range<functors::forward, functors::equal_to, context_t<Rng>> operator()(Rng rng) const
+        requires Range<Rng>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+
+private:
+    friend group_sorted;
+
+    template<typename Search, typename Proj, typename Equiv, typename Rng>
+    static constexpr group_range<Proj, Equiv, context_t<Rng>, Search> make(Proj&& proj, Equiv&& equiv, Rng rng)
+    {
+        auto&& [ctx, from, to] = rng;
+
+        // the first grouping is left empty, to be settled when it is first accessed or incremented
+        if constexpr(BidirectionalContext<decltype(ctx)>) {
+            return {
+                { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), from, to },
+                { from, std::move(from) },
+                { to, std::move(to) },
+            };
+        } else {
+            return {
+                { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), std::move(to) },
+                { from, std::move(from) },
+                {},
+            };
+        }
+    }
+};
+
 /**
  * .. var:: constexpr functors::group group
  *
@@ -256,6 +902,20 @@ namespace functors {
  *         If the elements of *rng* are sorted with respect to their criteria according to an ordering compatible with
  *         *equiv*, then the result of `group` is a range over the equivalence classes induced by *proj* and *equiv*.
  *
+ *         Except where the vectorised search described with the overload below applies, traversing the result from its
+ *         start to its end invokes *proj* exactly once per element of *rng*: the criterion of the element that ends a
+ *         grouping is kept in the context, to be used for the next grouping. Likewise *equiv* is invoked once per
+ *         element but the first, and each position of *rng* is incremented once. This is no more work than the loop
+ *         given as an equivalent below, which projects and compares the first element of each grouping twice. The
+ *         vectorised search does less still: *proj* is invoked once per grouping, *equiv* never, and the elements of a
+ *         grouping are skipped over by a single move of the position. When ``ANNEX_RANGE_GROUP_STATISTICS`` is
+ *         defined, these counts can be checked on a given range with ``classes.context.statistics()``, see
+ *         `group_statistics`. A position of the result consists of two positions of ``Ctx``, and is as costly to copy.
+ *
+ *         Since that criterion is kept in the context of the result, incrementing a position modifies the context:
+ *         like with `lazy_group` the result must not be traversed from several threads at once without
+ *         synchronisation.
+ *
  *         .. table:: |equivalents|
  *             :class: collapsed
  *
@@ -340,7 +1000,8 @@ namespace functors {
  *           |            |                                                                                     |
  *           +------------+-------------------------------------------------------------------------------------+
  *         :additional construction complexity:
- *           Linear time with respect to the number of elements of *ctx*.
+ *           Linear time with respect to the number of elements of the first grouping. See `lazy_group` for a constant
+ *           time alternative.
  *         :simple context members:
  *           ``grouping_projection``: *proj*
  *
@@ -354,6 +1015,9 @@ namespace functors {
  *         Create a range over the successive groupings of elements of *rng* that compare equal. Equivalent to
  *         `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
  *
+ *         If *rng* has a `ContiguousContext` of integral or floating-point elements, then the end of each grouping is
+ *         looked for using vector instructions when the target supports them.
+ *
  *         :param rng: `Saveable` `Range` of `EqualityComparable` elements. Additionally, the elements must be
  *           references or model `Copyable`.
  */
@@ -362,45 +1026,11 @@ struct group: impl::range_function<group> {
     constexpr group_range<Proj, Equiv, context_t<Rng>> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
         requires Range<Rng>
     {
-        auto&& [ctx, from, to] = rng;
-
-        if(range::equal_pos(ctx, from, to)) {
-            if constexpr(BidirectionalContext<decltype(ctx)>) {
-                return {
-                    { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), from, to },
-                    { to, to, {} },
-                    { to, std::move(to), {} },
-                };
-            } else {
-                return {
-                    { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), to },
-                    { from, from, {} },
-                    {},
-                };
-            }
-        }
-        auto&& criterion = range::peek_at(ctx, from);
-        auto needle = from;
-        for(; !range::equal_pos(ctx, needle, to); range::incr(ctx, needle)) {
-            if(!annex::invoke(annex::as_const(equiv), criterion,
-                              annex::invoke(annex::as_const(proj), range::peek_at(ctx, needle)) )) {
-                break;
-            }
-        }
-
-        if constexpr(BidirectionalContext<decltype(ctx)>) {
-            return {
-                { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), from, to },
-                { std::move(from), std::move(needle), { std::forward<decltype(criterion)>(criterion) } },
-                { to, std::move(to), {} },
-            };
-        } else {
-            return {
-                { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(ctx), to },
-                { std::move(from), std::move(needle), { std::forward<decltype(criterion)>(criterion) } },
-                {},
-            };
-        }
+        group_range<Proj, Equiv, context_t<Rng>> result = functors::lazy_group {}(std::forward<Proj>(proj),
+                                                                                 std::forward<Equiv>(equiv),
+                                                                                 std::move(rng));
+        result.context.settle(result.from);
+        return result;
     }
 
     MoveConstructible{Rng}
@@ -409,6 +1039,54 @@ struct group: impl::range_function<group> {
     { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
 };
 
+/**
+ * .. var:: constexpr functors::group_sorted group_sorted
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   constexpr group_range<Proj, Equiv, context_t<Rng>, group_search::galloping> \
+ *                   operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         A variant of `group` for ranges that are sorted with respect to the criteria of their elements, according to
+ *         an ordering compatible with *equiv*. The end of each grouping is found with a `group_search::galloping`
+ *         search rather than by examining every element, so that *proj* and *equiv* are only invoked a logarithmic
+ *         number of times with respect to the length of the grouping. Otherwise equivalent to
+ *         `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv), std::move(rng)) <group::operator()>`.
+ *
+ *         :param rng: `Saveable` `Range` with a `RandomAccessContext`. Its elements must be sorted as described.
+ *         :additional construction complexity:
+ *           Logarithmic time with respect to the number of elements of the first grouping.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   constexpr group_range<functors::forward, functors::equal_to, context_t<Rng>, group_search::galloping> \
+ *                   operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+struct group_sorted: impl::range_function<group_sorted> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    constexpr group_range<Proj, Equiv, context_t<Rng>, group_search::galloping>
+    operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    {
+        group_range<Proj, Equiv, context_t<Rng>, group_search::galloping> result =
+            functors::lazy_group::make<group_search::galloping>(std::forward<Proj>(proj),
+                                                                std::forward<Equiv>(equiv),
+                                                                std::move(rng));
+        result.context.settle(result.from);
+        return result;
+    }
+
+    MoveConstructible{Rng}
+    constexpr group_range<functors::forward, functors::equal_to, context_t<Rng>, group_search::galloping>
+    operator()(Rng rng) const
+        requires Range<Rng> && RandomAccessContext<context_t<Rng>>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
 /**
  * .. var:: constexpr functors::group_by group_by
  *
@@ -425,19 +1103,263 @@ struct group_by: impl::range_function<group_by> {
     template<ForwardableType Proj, MoveConstructible Rng>
     constexpr group_range<Proj, functors::equal_to, context_t<Rng>> operator()(Proj&& proj, Rng rng) const
         requires Range<Rng>
-    { return { std::forward<Proj>(proj), {}, std::move(rng) }; }
+    { return group {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::group_count group_count
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   constexpr std::size_t operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         The number of groupings of `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv), std::move(rng))
+ *         <group::operator()>`. Usable in constant expressions, see `static_group`.
+ *
+ *         :complexity:
+ *           Linear time with respect to the number of elements of *rng*.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   constexpr std::size_t operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+struct group_count: impl::range_function<group_count> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    constexpr std::size_t operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng>
+    {
+        auto grouped = group {}(std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(rng));
+
+        std::size_t count = 0;
+        for(auto pos = grouped.from; !range::equal_pos(grouped.context, pos, grouped.to);
+            range::incr(grouped.context, pos)) {
+            ++count;
+        }
+        return count;
+    }
+
+    MoveConstructible{Rng}
+    constexpr std::size_t operator()(Rng rng) const
+        requires Range<Rng>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: template<std::size_t N> constexpr functors::static_group<N> static_group
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng> \
+ *                   constexpr std::array<std::pair<std::size_t, std::size_t>, N> \
+ *                   operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+ *
+ *         The groupings of `group(std::forward\<Proj\>(proj), std::forward\<Equiv\>(equiv), std::move(rng))
+ *         <group::operator()>` as pairs of the offsets of their first element and of the element past their last one,
+ *         with *N* the number of groupings as given by `group_count`. When *rng* is a constant the whole computation
+ *         can take place at compile time, leaving no work to do at startup::
+ *
+ *             constexpr std::array<int, 6> table { 1, 1, 2, 3, 3, 3 };
+ *             constexpr auto bounds = static_group<group_count(table)>(table);
+ *             static_assert(bounds.size() == 3);
+ *             static_assert(bounds[2] == std::pair<std::size_t, std::size_t> { 3, 6 });
+ *
+ *         :complexity:
+ *           Linear time with respect to the number of elements of *rng*.
+ *         :exceptions:
+ *           ``std::length_error`` if *N* is not the number of groupings, which fails the evaluation of a constant
+ *           expression.
+ *
+ *     .. function:: MoveConstructible{Rng} \
+ *                   constexpr std::array<std::pair<std::size_t, std::size_t>, N> operator()(Rng rng) const
+ *
+ *         Equivalent to `operator()(functors::forward {}, functors::equal_to {}, std::move(rng)) <operator()>`.
+ */
+template<std::size_t N>
+struct static_group: impl::range_function<static_group<N>> {
+    template<ForwardableType Proj, ForwardableType Equiv, MoveConstructible Rng>
+    constexpr std::array<std::pair<std::size_t, std::size_t>, N> operator()(Proj&& proj, Equiv&& equiv, Rng rng) const
+        requires Range<Rng>
+    {
+        auto grouped = group {}(std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(rng));
+
+        std::array<std::pair<std::size_t, std::size_t>, N> bounds {};
+        std::size_t count = 0;
+        std::size_t start = 0;
+        for(auto pos = grouped.from; !range::equal_pos(grouped.context, pos, grouped.to);
+            range::incr(grouped.context, pos)) {
+            if(count == N) {
+                throw std::length_error("static_group: more groupings than requested");
+            }
+
+            auto&& [ctx, from, to] = range::at(grouped.context, pos);
+            auto stop = start;
+            for(; !range::equal_pos(ctx, from, to); range::incr(ctx, from)) {
+                ++stop;
+            }
+            bounds[count++] = { start, stop };
+            start = stop;
+        }
+
+        if(count != N) {
+            throw std::length_error("static_group: fewer groupings than requested");
+        }
+        return bounds;
+    }
+
+    MoveConstructible{Rng}
+    constexpr std::array<std::pair<std::size_t, std::size_t>, N> operator()(Rng rng) const
+        requires Range<Rng>
+    { return (*this)(functors::forward {}, functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: template<std::size_t N> constexpr functors::static_group_by<N> static_group_by
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, MoveConstructible Rng> \
+ *                   constexpr std::array<std::pair<std::size_t, std::size_t>, N> operator()(Proj&& proj, Rng rng) const
+ *
+ *         Equivalent to `static_group\<N\>(std::forward\<Proj\>(proj), functors::equal_to {}, std::move(rng))
+ *         <static_group::operator()>`.
+ */
+template<std::size_t N>
+struct static_group_by: impl::range_function<static_group_by<N>> {
+    template<ForwardableType Proj, MoveConstructible Rng>
+    constexpr std::array<std::pair<std::size_t, std::size_t>, N> operator()(Proj&& proj, Rng rng) const
+        requires Range<Rng>
+    { return static_group<N> {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(rng)); }
+};
+
+/**
+ * .. var:: constexpr functors::group_reduce group_reduce
+ *
+ *     .. warning:: |experimental-feature|
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, ForwardableType Equiv, CopyConstructible T, ForwardableType Op, \
+ *                            MoveConstructible Rng> \
+ *                   constexpr group_reduce_range<Proj, Equiv, T, Op, context_t<Rng>> \
+ *                   operator()(Proj&& proj, Equiv&& equiv, T init, Op&& op, Rng rng) const
+ *
+ *         :notation:
+ *             .. type:: Ctx = context_t<Rng>
+ *             .. type:: peek_t = peek_element_t<Ctx>
+ *             .. type:: proj_t = safe_t<result<meta::as_const<Proj&>, peek_t>>
+ *
+ *         Create a range over the successive groupings of *rng* as determined by *proj* and *equiv* (see `group`),
+ *         where each grouping is reduced as it is traversed. The elements of the result are pairs of the criterion of a
+ *         grouping and of the left fold of its elements by *op*, starting from a copy of *init*::
+ *
+ *             // pairs of a key and of the number of consecutive records with that key
+ *             auto counts = group_reduce(&record::key, std::equal_to<> {}, 0, [](int n, auto&&) { return n + 1; }, records);
+ *
+ *         Unlike with `group` no subrange is ever created, and each element of *rng* is only peeked once, both for its
+ *         criterion and for its reduction.
+ *
+ *         :param op: Must satisfy `Invokable\<meta::as_const\<Op&\>, T, peek_t\> <Invokable>`, with a result of type
+ *           ``T``.
+ *         :param rng: `Saveable` `Range`. Additionally, ``proj_t`` must be a reference type or model `Copyable`.
+ *         :models:
+ *           `Range` with the following |range-properties|:
+ *
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Element    | ``std::pair<proj_t, T> const&``                                                     |
+ *           | types      |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Traversal  | `MultipassContext`                                                                  |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *           | Saveable   | if and only if `Proj`, `Equiv` and `Op` model `CopyConstructible`                   |
+ *           |            |                                                                                     |
+ *           +------------+-------------------------------------------------------------------------------------+
+ *         :additional construction complexity:
+ *           Linear time with respect to the number of elements of the first grouping.
+ *         :simple context members:
+ *           ``grouping_projection``: *proj*
+ *
+ *           ``grouping_equivalence``: *equiv*
+ *
+ *           ``reduction_init``: *init*
+ *
+ *           ``reduction_operation``: *op*
+ *
+ *           ``grouped_context``: *ctx*
+ */
+struct group_reduce: impl::range_function<group_reduce> {
+    template<ForwardableType Proj, ForwardableType Equiv, CopyConstructible T, ForwardableType Op, MoveConstructible Rng>
+    constexpr group_reduce_range<Proj, Equiv, T, Op, context_t<Rng>>
+    operator()(Proj&& proj, Equiv&& equiv, T init, Op&& op, Rng rng) const
+        requires Range<Rng>
+    {
+        auto&& [ctx, from, to] = rng;
+
+        group_reduce_range<Proj, Equiv, T, Op, context_t<Rng>> result {
+            { std::forward<Proj>(proj), std::forward<Equiv>(equiv), std::move(init), std::forward<Op>(op),
+              std::move(ctx), std::move(to) },
+            { std::move(from), {}, {} },
+            {},
+        };
+        result.context.incr(result.from);
+        return result;
+    }
+};
+
+/**
+ * .. var:: constexpr functors::group_by_reduce group_by_reduce
+ *
+ *     |range-function|
+ *
+ *     .. function:: template<ForwardableType Proj, CopyConstructible T, ForwardableType Op, MoveConstructible Rng> \
+ *                   constexpr group_reduce_range<Proj, functors::equal_to, T, Op, context_t<Rng>> \
+ *                   operator()(Proj&& proj, T init, Op&& op, Rng rng) const
+ *
+ *         Equivalent to `group_reduce(std::forward\<Proj\>(proj), functors::equal_to {}, std::move(init),
+ *         std::forward\<Op\>(op), std::move(rng)) <group_reduce::operator()>`.
+ */
+struct group_by_reduce: impl::range_function<group_by_reduce> {
+    template<ForwardableType Proj, CopyConstructible T, ForwardableType Op, MoveConstructible Rng>
+    constexpr group_reduce_range<Proj, functors::equal_to, T, Op, context_t<Rng>>
+    operator()(Proj&& proj, T init, Op&& op, Rng rng) const
+        requires Range<Rng>
+    {
+        return group_reduce {}(std::forward<Proj>(proj), functors::equal_to {}, std::move(init), std::forward<Op>(op),
+                               std::move(rng));
+    }
 };
 
 } // functors
 
 inline constexpr functors::group group {};
+inline constexpr functors::lazy_group lazy_group {};
+inline constexpr functors::group_sorted group_sorted {};
 inline constexpr functors::group_by group_by {};
+inline constexpr functors::group_count group_count {};
+template<std::size_t N> inline constexpr functors::static_group<N> static_group {};
+template<std::size_t N> inline constexpr functors::static_group_by<N> static_group_by {};
+inline constexpr functors::group_reduce group_reduce {};
+inline constexpr functors::group_by_reduce group_by_reduce {};
 
 namespace result_of {
-Types{... Args} using group    = decltype( range::group(std::declval<Args>()...) );
-Types{... Args} using group_by = decltype( range::group_by(std::declval<Args>()...) );
+Types{... Args} using group           = decltype( range::group(std::declval<Args>()...) );
+Types{... Args} using lazy_group      = decltype( range::lazy_group(std::declval<Args>()...) );
+Types{... Args} using group_sorted    = decltype( range::group_sorted(std::declval<Args>()...) );
+Types{... Args} using group_by        = decltype( range::group_by(std::declval<Args>()...) );
+Types{... Args} using group_count     = decltype( range::group_count(std::declval<Args>()...) );
+template<std::size_t N, typename... Args>
+using static_group = decltype( range::static_group<N>(std::declval<Args>()...) );
+template<std::size_t N, typename... Args>
+using static_group_by = decltype( range::static_group_by<N>(std::declval<Args>()...) );
+Types{... Args} using group_reduce    = decltype( range::group_reduce(std::declval<Args>()...) );
+Types{... Args} using group_by_reduce = decltype( range::group_by_reduce(std::declval<Args>()...) );
 } // result_of
 
 } // annex::range
 
+#undef ANNEX_RANGE_GROUP_SIMD
+
 #endif /* ANNEX_RANGE_TRANSFORMATION_GROUP_HPP_INCLUDED */